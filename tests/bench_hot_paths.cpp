@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <drogon/drogon.h>
+
+#include "utils.h"
+#include "Jwt.h"
+#include "Department.h"
+#include "Person.h"
+
+using namespace drogon;
+using namespace drogon_model::org_chart;
+
+// Jwt::encode / Jwt::decode
+
+static void BM_JwtEncode(benchmark::State &state) {
+    Jwt jwt("benchmark-secret", 3600, "auth0");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(jwt.encode("user_id", 42));
+    }
+}
+BENCHMARK(BM_JwtEncode);
+
+static void BM_JwtDecode(benchmark::State &state) {
+    Jwt jwt("benchmark-secret", 3600, "auth0");
+    const auto token = jwt.encode("user_id", 42);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(jwt.decode(token));
+    }
+}
+BENCHMARK(BM_JwtDecode);
+
+// makeErrResp / badRequest
+
+static void BM_MakeErrResp(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(makeErrResp("resource not found"));
+    }
+}
+BENCHMARK(BM_MakeErrResp);
+
+static void BM_BadRequest(benchmark::State &state) {
+    for (auto _ : state) {
+        badRequest([](const HttpResponsePtr &resp) {
+            benchmark::DoNotOptimize(resp);
+        }, "invalid input");
+    }
+}
+BENCHMARK(BM_BadRequest);
+
+// Model to JSON conversion
+
+static void BM_DepartmentToJson(benchmark::State &state) {
+    Json::Value json;
+    json["id"] = 1;
+    json["name"] = "Engineering";
+    for (auto _ : state) {
+        Department department(json);
+        benchmark::DoNotOptimize(department.toJson());
+    }
+}
+BENCHMARK(BM_DepartmentToJson);
+
+static void BM_PersonToJson(benchmark::State &state) {
+    Json::Value json;
+    json["id"] = 1;
+    json["job_id"] = 2;
+    json["department_id"] = 3;
+    json["manager_id"] = 4;
+    json["first_name"] = "Ada";
+    json["last_name"] = "Lovelace";
+    json["hire_date"] = "2020-01-01";
+    for (auto _ : state) {
+        Person person(json);
+        benchmark::DoNotOptimize(person.toJson());
+    }
+}
+BENCHMARK(BM_PersonToJson);